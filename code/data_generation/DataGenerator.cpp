@@ -0,0 +1,235 @@
+#include "DataGenerator.h"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <thread>
+
+namespace {
+
+// Rows per chunk; each chunk has its own RNG stream
+const std::uint64_t kChunkRows = 1 << 16;
+
+// Column layout in hundredths: Aroma, Flavor, Aftertaste, Acidity, Body,
+// Balance, Uniformity, Sweetness, Moisture
+const int kColumns = 9;
+const int kFlavor = 1;
+const int kMaxHundredths[kColumns] = {1000, 1000, 1000, 1000, 1000,
+                                      1000, 1000, 1000, 30};
+
+// Ground-truth linear model over the eight features (LinearRegression order)
+const double kLinearBias = 0.5;
+const double kLinearWeights[kColumns - 1] = {0.25, 0.20, 0.15, 0.10,
+                                             0.10, 0.05, 0.05, -2.0};
+
+// Binary file header: magic, column count, row count, header length
+const char kMagic[8] = {'C', 'O', 'F', 'F', 'E', 'E', 'B', '1'};
+
+std::uint64_t splitmix64(std::uint64_t x) {
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+// Uniform double in [0, 1); avoids std distributions, whose output is
+// implementation-defined
+double uniform01(std::mt19937_64& rng) {
+    return (rng() >> 11) * (1.0 / 9007199254740992.0);
+}
+
+double gaussian(std::mt19937_64& rng) {
+    double u1 = 1.0 - uniform01(rng);
+    double u2 = uniform01(rng);
+    return std::sqrt(-2.0 * std::log(u1)) * std::cos(6.283185307179586 * u2);
+}
+
+// Append h / 100 with two decimals, e.g. 845 -> "8.45"
+void appendHundredths(std::string& buf, int h) {
+    char tmp[8];
+    int n = 0;
+    tmp[n++] = char('0' + h % 10);
+    tmp[n++] = char('0' + (h / 10) % 10);
+    tmp[n++] = '.';
+    int whole = h / 100;
+    do {
+        tmp[n++] = char('0' + whole % 10);
+        whole /= 10;
+    } while (whole > 0);
+    while (n > 0) buf.push_back(tmp[--n]);
+}
+
+} // namespace
+
+DataGenerator::DataGenerator(std::uint64_t rows, std::uint64_t seed, unsigned threads)
+    : rows_(rows), seed_(seed), threads_(threads) {
+    if (threads_ == 0) threads_ = std::max(1u, std::thread::hardware_concurrency());
+}
+
+void DataGenerator::setFormat(Format format) {
+    format_ = format;
+}
+
+void DataGenerator::setTruth(Truth truth, double noise) {
+    truth_ = truth;
+    noise_ = noise;
+}
+
+const std::vector<std::string>& DataGenerator::columns() {
+    static const std::vector<std::string> cols = {
+        "Data.Scores.Aroma", "Data.Scores.Flavor", "Data.Scores.Aftertaste",
+        "Data.Scores.Acidity", "Data.Scores.Body", "Data.Scores.Balance",
+        "Data.Scores.Uniformity", "Data.Scores.Sweetness", "Data.Scores.Moisture"
+    };
+    return cols;
+}
+
+bool DataGenerator::parseFormat(const std::string& name, Format& format) {
+    if (name == "csv") format = Format::CSV;
+    else if (name == "bin") format = Format::Binary;
+    else return false;
+    return true;
+}
+
+bool DataGenerator::parseTruth(const std::string& name, Truth& truth) {
+    if (name == "none") truth = Truth::None;
+    else if (name == "linear") truth = Truth::Linear;
+    else if (name == "tree") truth = Truth::Tree;
+    else return false;
+    return true;
+}
+
+void DataGenerator::printTruth() const {
+    if (truth_ == Truth::Linear) {
+        std::cout << "Ground truth (linear): Flavor = " << kLinearBias;
+        for (int j = 0; j < kColumns - 1; ++j)
+            std::cout << " + " << kLinearWeights[j] << "*" << columns()[j < kFlavor ? j : j + 1];
+        std::cout << " + N(0, " << noise_ << ")\n";
+    } else if (truth_ == Truth::Tree) {
+        std::cout << "Ground truth (tree): Aroma<5 ? (Aftertaste<5 ? 2.5 : 4.5)"
+                  << " : (Acidity<5 ? 5.5 : (Body<5 ? 7.0 : 8.5))"
+                  << " + N(0, " << noise_ << ")\n";
+    }
+}
+
+double DataGenerator::groundTruth(const int* h) const {
+    // Features in LinearRegression order, skipping Flavor
+    double x[kColumns - 1];
+    for (int j = 0, k = 0; j < kColumns; ++j)
+        if (j != kFlavor) x[k++] = h[j] / 100.0;
+
+    if (truth_ == Truth::Linear) {
+        double v = kLinearBias;
+        for (int j = 0; j < kColumns - 1; ++j) v += kLinearWeights[j] * x[j];
+        return v;
+    }
+    // Truth::Tree on Aroma, Aftertaste, Acidity, Body
+    if (x[0] < 5.0) return x[1] < 5.0 ? 2.5 : 4.5;
+    if (x[2] < 5.0) return 5.5;
+    return x[3] < 5.0 ? 7.0 : 8.5;
+}
+
+void DataGenerator::generateChunk(std::uint64_t chunk, std::uint64_t count,
+                                  std::string& buf) const {
+    std::mt19937_64 rng(splitmix64(seed_ ^ splitmix64(chunk)));
+    buf.clear();
+    buf.reserve(format_ == Format::CSV ? count * 48 : count * kColumns * sizeof(double));
+
+    int h[kColumns];
+    for (std::uint64_t r = 0; r < count; ++r) {
+        for (int j = 0; j < kColumns; ++j)
+            h[j] = int(uniform01(rng) * (kMaxHundredths[j] + 1));
+
+        if (truth_ != Truth::None) {
+            double v = groundTruth(h) + noise_ * gaussian(rng);
+            v = std::min(10.0, std::max(0.0, v));
+            h[kFlavor] = int(std::lround(v * 100.0));
+        }
+
+        if (format_ == Format::CSV) {
+            for (int j = 0; j < kColumns; ++j) {
+                if (j > 0) buf.push_back(',');
+                appendHundredths(buf, h[j]);
+            }
+            buf.push_back('\n');
+        } else {
+            for (int j = 0; j < kColumns; ++j) {
+                double d = h[j] / 100.0;
+                buf.append(reinterpret_cast<const char*>(&d), sizeof(d));
+            }
+        }
+    }
+}
+
+bool DataGenerator::write(const std::string& path) const {
+    std::ofstream out(path, std::ios::binary);
+    if (!out.is_open()) {
+        std::cerr << "Failed to open: " << path << "\n";
+        return false;
+    }
+
+    std::string header;
+    for (size_t j = 0; j < columns().size(); ++j) {
+        if (j > 0) header.push_back(',');
+        header += columns()[j];
+    }
+
+    if (format_ == Format::CSV) {
+        out << header << "\n";
+    } else {
+        // Layout: magic[8], uint32 columns, uint64 rows, uint32 header length,
+        // header bytes, then rows of native float64 values in column order
+        std::uint32_t cols = kColumns;
+        std::uint32_t len = std::uint32_t(header.size());
+        out.write(kMagic, sizeof(kMagic));
+        out.write(reinterpret_cast<const char*>(&cols), sizeof(cols));
+        out.write(reinterpret_cast<const char*>(&rows_), sizeof(rows_));
+        out.write(reinterpret_cast<const char*>(&len), sizeof(len));
+        out.write(header.data(), len);
+    }
+
+    // Workers fill one batch of chunk buffers while the previous batch is
+    // written, so generation overlaps with disk I/O
+    const std::uint64_t chunks = rows_ / kChunkRows + (rows_ % kChunkRows != 0);
+    std::vector<std::string> batches[2];
+    batches[0].resize(threads_);
+    batches[1].resize(threads_);
+
+    auto launch = [&](std::uint64_t base, std::vector<std::string>& bufs) {
+        std::vector<std::thread> workers;
+        for (unsigned t = 0; t < threads_ && base + t < chunks; ++t) {
+            std::uint64_t chunk = base + t;
+            std::uint64_t count = std::min(kChunkRows, rows_ - chunk * kChunkRows);
+            workers.emplace_back([this, chunk, count, &bufs, t] {
+                generateChunk(chunk, count, bufs[t]);
+            });
+        }
+        return workers;
+    };
+
+    std::vector<std::thread> workers = launch(0, batches[0]);
+    int cur = 0;
+    for (std::uint64_t base = 0; base < chunks; base += threads_) {
+        for (auto& w : workers) w.join();
+        unsigned filled = unsigned(std::min<std::uint64_t>(threads_, chunks - base));
+        workers = launch(base + threads_, batches[1 - cur]);
+        for (unsigned t = 0; t < filled; ++t)
+            out.write(batches[cur][t].data(), std::streamsize(batches[cur][t].size()));
+        if (!out) {
+            for (auto& w : workers) w.join();
+            std::cerr << "Failed to write: " << path << "\n";
+            return false;
+        }
+        cur = 1 - cur;
+    }
+    for (auto& w : workers) w.join();
+
+    // The last buffered bytes (or the header alone) are only flushed here
+    out.close();
+    if (!out) {
+        std::cerr << "Failed to write: " << path << "\n";
+        return false;
+    }
+    return true;
+}
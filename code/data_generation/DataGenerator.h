@@ -0,0 +1,53 @@
+#ifndef DATA_GENERATOR_H
+#define DATA_GENERATOR_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Native replacement for data_gen.py that can produce 10M+ rows of the
+// Data.Scores.* schema. Rows are generated in fixed-size chunks, each with
+// its own RNG stream derived from the seed, so the output is identical for
+// a given seed regardless of the number of threads.
+class DataGenerator {
+public:
+    enum class Format { CSV, Binary };
+    enum class Truth { None, Linear, Tree };
+
+    // rows: number of rows to write; seed: base RNG seed;
+    // threads: worker count (0 = hardware concurrency)
+    DataGenerator(std::uint64_t rows, std::uint64_t seed, unsigned threads = 0);
+
+    // Output format and optional ground-truth relationship for Flavor
+    void setFormat(Format format);
+    void setTruth(Truth truth, double noise = 0.25);
+
+    // Write the dataset to path; returns false if the file cannot be written
+    bool write(const std::string& path) const;
+
+    // Describe the ground-truth relationship (empty when Truth::None)
+    void printTruth() const;
+
+    // Column names in output order (Flavor is column 1, as in data_gen.py)
+    static const std::vector<std::string>& columns();
+
+    static bool parseFormat(const std::string& name, Format& format);
+    static bool parseTruth(const std::string& name, Truth& truth);
+
+private:
+    std::uint64_t rows_;
+    std::uint64_t seed_;
+    unsigned threads_;
+    Format format_ = Format::CSV;
+    Truth truth_ = Truth::None;
+    double noise_ = 0.25;
+
+    // Fill buf with the count encoded rows of one chunk
+    void generateChunk(std::uint64_t chunk, std::uint64_t count,
+                       std::string& buf) const;
+
+    // Flavor score (0-10 scale) from the other features, given in hundredths
+    double groundTruth(const int* hundredths) const;
+};
+
+#endif // DATA_GENERATOR_H
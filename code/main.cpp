@@ -1,5 +1,6 @@
 #include "Linear_Regression/LinearRegression.h"
 #include "Decision_Tree/DecisionTree.h"
+#include "data_generation/DataGenerator.h"
 #include <iostream>
 #include <fstream>
 #include <sstream>
@@ -9,6 +10,9 @@
 #include <random>
 #include <numeric>
 #include <cmath>
+#include <climits>
+#include <stdexcept>
+#include <thread>
 using namespace std;
 
 // helpers for decision tree model
@@ -28,7 +32,39 @@ double calcR2(const std::vector<double>& y, const std::vector<double>& p) {
     return 1 - res/tot;
 }
 
+// helpers for command line arguments
+void printUsage() {
+    std::cerr << "Usage:\n"
+              << "  project3.exe Linear_Regression <path> <alpha> <iterations>\n"
+              << "  project3.exe Decision_Tree <path> <max_depth> <min_samples_split>\n"
+              << "  project3.exe Generate <path> <rows> <seed> [threads] [csv|bin] [none|linear|tree] [noise]\n";
+}
+// stoull accepts "-1" and wraps it, so only plain digits are allowed here
+bool parseCount(const std::string& s, unsigned long long max, unsigned long long& out) {
+    if (s.empty() || s.find_first_not_of("0123456789") != std::string::npos) return false;
+    try {
+        out = std::stoull(s);
+    } catch (const std::out_of_range&) {
+        return false;
+    }
+    return out <= max;
+}
+// noise must be a finite, non-negative standard deviation
+bool parseNoise(const std::string& s, double& out) {
+    size_t used = 0;
+    try {
+        out = std::stod(s, &used);
+    } catch (const std::exception&) {
+        return false;
+    }
+    return used == s.size() && std::isfinite(out) && out >= 0.0;
+}
+
 int main(int argc, char* argv []) {
+    if (argc < 2) {
+        printUsage();
+        return 1;
+    }
     string mode = argv[1];
     if (mode == "Linear_Regression") {
         const string path = argv[2];
@@ -39,7 +75,7 @@ int main(int argc, char* argv []) {
         model.printWeights();
         model.saveResults();
     }
-    if (mode == "Decision_Tree") {
+    else if (mode == "Decision_Tree") {
         const string path = argv[2];
         std::ifstream file(path);
         if (!file.is_open()) {
@@ -151,5 +187,49 @@ int main(int argc, char* argv []) {
         }
         impfile.close();
     }
+    else if (mode == "Generate") {
+        // Generate <path> <rows> <seed> [threads] [csv|bin] [none|linear|tree] [noise]
+        // each thread holds two chunk buffers (~3 MB each for csv)
+        const unsigned long long maxThreads = 4ULL * std::max(1u, std::thread::hardware_concurrency());
+        const unsigned long long maxRows = 1000000000000ULL;
+        unsigned long long rows = 0, seed = 0, threads = 0;
+        if (argc < 5 || !parseCount(argv[3], maxRows, rows) ||
+            !parseCount(argv[4], ULLONG_MAX, seed) ||
+            (argc > 5 && !parseCount(argv[5], maxThreads, threads))) {
+            printUsage();
+            return 1;
+        }
+        const string path = argv[2];
+        DataGenerator gen(rows, seed, unsigned(threads));
+
+        DataGenerator::Format format = DataGenerator::Format::CSV;
+        if (argc > 6 && !DataGenerator::parseFormat(argv[6], format)) {
+            std::cerr << "Unknown format " << argv[6] << "\n";
+            printUsage();
+            return 1;
+        }
+        DataGenerator::Truth truth = DataGenerator::Truth::None;
+        if (argc > 7 && !DataGenerator::parseTruth(argv[7], truth)) {
+            std::cerr << "Unknown ground truth " << argv[7] << "\n";
+            printUsage();
+            return 1;
+        }
+        double noise = 0.25;
+        if (argc > 8 && !parseNoise(argv[8], noise)) {
+            std::cerr << "Invalid noise " << argv[8] << "\n";
+            printUsage();
+            return 1;
+        }
+        gen.setFormat(format);
+        gen.setTruth(truth, noise);
+        gen.printTruth();
+        if (!gen.write(path)) return 1;
+        std::cout << "Wrote " << rows << " rows to " << path << "\n";
+    }
+    else {
+        std::cerr << "Unknown mode " << mode << "\n";
+        printUsage();
+        return 1;
+    }
     return 0;
 }
\ No newline at end of file